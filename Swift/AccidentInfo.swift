@@ -48,9 +48,7 @@ import ZendriveSDK
 
 
     /// The location of the accident.
-    @objc public var accidentLocation: LocationPoint {
-        return LocationPoint.fromObjcLocationPoint(self.internalAccidentInfo.accidentLocation)
-    }
+    @objc public let accidentLocation: LocationPoint
 
 
     /// The timestamp of the accident in milliseconds since epoch.
@@ -101,17 +99,16 @@ import ZendriveSDK
         return self.internalAccidentInfo.accidentId
     }
 
-    internal var internalAccidentInfo: ZendriveSDK.ZendriveAccidentInfo!
+    internal let internalAccidentInfo: ZendriveSDK.ZendriveAccidentInfo
 
     @objc override convenience init() {
         self.init(with: ZendriveSDK.ZendriveAccidentInfo())
     }
 
-    convenience init(with objcAccidentInfo: ZendriveSDK.ZendriveAccidentInfo) {
-        self.init(location: LocationPoint.fromObjcLocationPoint(objcAccidentInfo.accidentLocation),
-                 timestamp: objcAccidentInfo.timestamp, trackingId: objcAccidentInfo.trackingId,
-                 sessionId: objcAccidentInfo.sessionId, confidence: AccidentConfidence.fromObjcAccidentConfidence(objcAccidentInfo.confidence), confidenceNumber: objcAccidentInfo.confidenceNumber,
-                accidentId: objcAccidentInfo.accidentId, driveId: objcAccidentInfo.driveId)
+    init(with objcAccidentInfo: ZendriveSDK.ZendriveAccidentInfo) {
+        self.accidentLocation = LocationPoint.fromObjcLocationPoint(objcAccidentInfo.accidentLocation)
+        self.internalAccidentInfo = objcAccidentInfo
+        super.init()
     }
 
     /// Initializer for `AccidentInfo`.
@@ -127,6 +124,7 @@ import ZendriveSDK
     ///   - driveId: The unique Id of drive during which the accident occured
     /// - Returns: `AccidentInfo` object
     @objc public init(location: LocationPoint, timestamp: Int64, trackingId: String?, sessionId: String?, confidence: AccidentConfidence, confidenceNumber: Int32, accidentId: String, driveId: String) {
+        self.accidentLocation = location
         self.internalAccidentInfo = ZendriveSDK.ZendriveAccidentInfo(location: location.internalLocationPoint,
                                                                      timestamp: timestamp, trackingId: trackingId,
                                                                      sessionId: sessionId, confidence: confidence.toObjcAccidentConfidence(), confidenceNumber: confidenceNumber, accidentId: accidentId,
@@ -39,14 +39,12 @@ import ZendriveSDK
     @objc override public init() {
         super.init()
         self.internalDriveScore = ZendriveSDK.ZendriveDriveScore()
-        self.zendriveScore = self.internalDriveScore.zendriveScore
     }
 
     /// Initializer for creating a `DriveScore` object.
     /// - Parameter zendriveScore: The `Zendrive` score for this drive.
     @objc public init(zendriveScore: Int32) {
         super.init()
-        self.zendriveScore = zendriveScore
         self.internalDriveScore = ZendriveSDK.ZendriveDriveScore(zendriveScore: zendriveScore)
     }
 }
@@ -204,22 +204,20 @@ import ZendriveSDK
     }
 
     static func convertArray(objcEvents: [ZendriveSDK.ZendriveEvent]?) -> [Event] {
-        var events: [Event] = []
-        if let objcEvents = objcEvents {
-            for event in objcEvents {
-                events.append(Event.fromObjcEvent(event))
-            }
+        guard let objcEvents = objcEvents else {
+            return []
+        }
+        return objcEvents.map { (event) in
+            return Event.fromObjcEvent(event)
         }
-        return events
     }
 
     static func convertArray(swiftEvents : [Event]?) -> [ZendriveEvent] {
-        var events: [ZendriveEvent] = []
-        if let swiftEvents = swiftEvents {
-            for event in swiftEvents {
-                events.append(event.toObjcEvent())
-            }
+        guard let swiftEvents = swiftEvents else {
+            return []
+        }
+        return swiftEvents.map { (event) in
+            return event.toObjcEvent()
         }
-        return events
     }
 }
@@ -42,6 +42,11 @@ import ZendriveSDK
         self.internalLocationPoint = ZendriveLocationPoint(timestamp: timestamp, latitude: latitude, longitude: longitude)
     }
 
+    init(with objcLocationPoint: ZendriveSDK.ZendriveLocationPoint) {
+        super.init()
+        self.internalLocationPoint = objcLocationPoint
+    }
+
     /// Compares any object with LocationPoint.
     /// - Parameter object: an object to be compared with this LocationPoint object.
     /// - Returns: `true` if the given object is equal to this LocationPoint object,
@@ -60,36 +65,36 @@ import ZendriveSDK
     }
 
     func toObjcLocationPoint() -> ZendriveLocationPoint {
-        return ZendriveLocationPoint(timestamp: timestamp,
-                                     latitude: latitude,
-                                     longitude: longitude)
+        return internalLocationPoint
     }
 
     static func fromObjcLocationPoint(_ objcLocationPoint:
         ZendriveSDK.ZendriveLocationPoint) -> LocationPoint {
-        return LocationPoint(timestamp: objcLocationPoint.timestamp, latitude: objcLocationPoint.latitude, longitude: objcLocationPoint.longitude)
+        // The SDK can hand over nil despite the nonnull annotation, e.g. for the
+        // locations of a default constructed `ZendriveEvent`.
+        guard let objcLocationPoint = objcLocationPoint as ZendriveSDK.ZendriveLocationPoint? else {
+            return LocationPoint(timestamp: 0, latitude: 0, longitude: 0)
+        }
+        return LocationPoint(with: objcLocationPoint)
     }
 
     static func convertArray(objcLocationPoints:
         [ZendriveSDK.ZendriveLocationPoint]?) -> [LocationPoint] {
-        var locationPoints: [LocationPoint] = []
-        if let objcLocationPoints = objcLocationPoints {
-            for objcLocationPoint in objcLocationPoints {
-                locationPoints.append(LocationPoint
-                    .fromObjcLocationPoint(objcLocationPoint))
-            }
+        guard let objcLocationPoints = objcLocationPoints else {
+            return []
+        }
+        return objcLocationPoints.map { (objcLocationPoint) in
+            return LocationPoint.fromObjcLocationPoint(objcLocationPoint)
         }
-        return locationPoints
     }
 
     static func convertArray(swiftLocationPoints:
         [LocationPoint]?) -> [ZendriveLocationPoint] {
-        var locationPoints: [ZendriveLocationPoint] = []
-        if let swiftLocationPoints = swiftLocationPoints {
-            for swiftLocationPoint in swiftLocationPoints {
-                locationPoints.append(swiftLocationPoint.toObjcLocationPoint())
-            }
+        guard let swiftLocationPoints = swiftLocationPoints else {
+            return []
+        }
+        return swiftLocationPoints.map { (swiftLocationPoint) in
+            return swiftLocationPoint.toObjcLocationPoint()
         }
-        return locationPoints
     }
 }
@@ -36,22 +36,20 @@ import ZendriveSDK
     }
 
     static func convertArray(objcTagInfos : [ZendriveTagInfo]?) -> [TagInfo] {
-        var tagInfos: [TagInfo] = []
-        if let objcTagInfos = objcTagInfos {
-            for objcTagInfo in objcTagInfos {
-                tagInfos.append(TagInfo(with: objcTagInfo))
-            }
+        guard let objcTagInfos = objcTagInfos else {
+            return []
+        }
+        return objcTagInfos.map { (objcTagInfo) in
+            return TagInfo(with: objcTagInfo)
         }
-        return tagInfos
     }
 
     static func convertArray(swiftTagInfos : [TagInfo]?) -> [ZendriveTagInfo] {
-        var tagInfos: [ZendriveTagInfo] = []
-        if let swiftTagInfos = swiftTagInfos {
-            for swiftTagInfo in swiftTagInfos {
-                tagInfos.append(swiftTagInfo.toObjcTagInfo())
-            }
+        guard let swiftTagInfos = swiftTagInfos else {
+            return []
+        }
+        return swiftTagInfos.map { (swiftTagInfo) in
+            return swiftTagInfo.toObjcTagInfo()
         }
-        return tagInfos
     }
 }
@@ -47,25 +47,23 @@ import ZendriveSDK
 
     static func convertArray(objcTripWarnings:
         [ZendriveSDK.ZendriveTripWarning]?) -> [TripWarning] {
-        var warnings: [TripWarning] = []
-        if let objcTripWarnings = objcTripWarnings {
-            for tripWarning in objcTripWarnings {
-                warnings.append(TripWarning(warning:
-                    TripWarningType.fromObjcTripWarningType(tripWarning
-                        .tripWarningType)))
-            }
+        guard let objcTripWarnings = objcTripWarnings else {
+            return []
+        }
+        return objcTripWarnings.map { (tripWarning) in
+            return TripWarning(warning:
+                TripWarningType.fromObjcTripWarningType(tripWarning
+                    .tripWarningType))
         }
-        return warnings
     }
 
     static func convertArray(swiftTripWarnings: [TripWarning]?) ->
         [ZendriveTripWarning] {
-        var warnings: [ZendriveTripWarning] = []
-        if let swiftTripWarnings = swiftTripWarnings {
-            for tripWarning in swiftTripWarnings {
-                warnings.append(tripWarning.toObjcTripWarning())
-            }
+        guard let swiftTripWarnings = swiftTripWarnings else {
+            return []
+        }
+        return swiftTripWarnings.map { (tripWarning) in
+            return tripWarning.toObjcTripWarning()
         }
-        return warnings
     }
 }